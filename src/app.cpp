@@ -199,6 +199,8 @@ bool App::InitializeComponents() {
     tracking_mode_ = config_->Data().mode;
     cursor_block_enabled_ = config_->Data().block_cursor;
     invert_colors_ = config_->Data().invert_colors;
+    grayscale_ = config_->Data().grayscale;
+    capture_->SetLumaMode(grayscale_);
     last_caret_target_tick_ = 0;
     last_user_activity_tick_ = GetTickCount64();
     status_overlay_dirty_ = true;
@@ -379,6 +381,9 @@ bool App::InitializeComponents() {
         case HotkeyAction::ToggleInvert:
             ToggleInvertColors();
             break;
+        case HotkeyAction::ToggleGrayscale:
+            ToggleGrayscale();
+            break;
         case HotkeyAction::ToggleMousePassThrough:
             cursor_block_enabled_ = !cursor_block_enabled_;
             config_->Data().block_cursor = cursor_block_enabled_;
@@ -625,6 +630,7 @@ void App::UpdateViewState() {
 
     view_state_.cursor_visible = false;
     view_state_.invert_colors = invert_colors_;
+    view_state_.grayscale = grayscale_;
     view_state_.cursor_x = 0.0f;
     view_state_.cursor_y = 0.0f;
 
@@ -954,6 +960,9 @@ void App::UpdateTray() {
     if (invert_colors_) {
         status += L" | INV";
     }
+    if (grayscale_) {
+        status += L" | GRAY";
+    }
     tray_->SetTooltip(status);
 }
 
@@ -1189,6 +1198,16 @@ void App::ToggleInvertColors() {
     UpdateTray();
 }
 
+void App::ToggleGrayscale() {
+    MarkUserActivity();
+    grayscale_ = !grayscale_;
+    capture_->SetLumaMode(grayscale_);
+    config_->Data().grayscale = grayscale_;
+    config_->Save();
+    ShowStatusMessage(grayscale_ ? L"Grayscale On" : L"Grayscale Off", kStatusBadgeDurationMs);
+    UpdateTray();
+}
+
 void App::ShowCurrentTimeBadge() {
     SYSTEMTIME current_time{};
     GetLocalTime(&current_time);
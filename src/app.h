@@ -62,6 +62,7 @@ private:
     void CheckKeyboardLayout();
     std::wstring LayoutCodeFromHKL(HKL layout) const;
     void ToggleInvertColors();
+    void ToggleGrayscale();
     void ShowCurrentTimeBadge();
     void ForceRestart();
     void RestartApplication();
@@ -147,6 +148,7 @@ private:
     bool ctrl_block_active_{false};
     HKL last_keyboard_layout_{nullptr};
     bool invert_colors_{false};
+    bool grayscale_{false};
     ULONGLONG last_user_activity_tick_{0};
     bool restart_pending_{false};
     std::wstring status_overlay_text_;
@@ -5,10 +5,29 @@
 
 #include <dxgi1_6.h>
 #include <d3d11_1.h>
+#include <d3dcompiler.h>
+#include <cstring>
 #include <vector>
 
 namespace {
 constexpr UINT kFrameTimeoutMs = 16;
+
+// Full-screen triangle generated from SV_VertexID; no vertex buffer needed.
+constexpr char kLumaVertexShader[] = R"(
+    float4 main(uint id : SV_VertexID) : SV_POSITION {
+        float2 uv = float2((id << 1) & 2, id & 2);
+        return float4(uv * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);
+    }
+)";
+
+// Rec. 709 luma, read texel-exact so the R8 target matches the source 1:1.
+constexpr char kLumaPixelShader[] = R"(
+    Texture2D source_tex : register(t0);
+    float main(float4 position : SV_POSITION) : SV_TARGET {
+        float3 color = source_tex.Load(int3(position.xy, 0)).rgb;
+        return dot(color, float3(0.2126, 0.7152, 0.0722));
+    }
+)";
 }
 
 CaptureEngine::CaptureEngine() = default;
@@ -42,6 +61,11 @@ void CaptureEngine::Shutdown() {
     }
     duplication_.Reset();
     staging_.Reset();
+    luma_rtv_.Reset();
+    luma_source_srv_.Reset();
+    luma_source_texture_ = nullptr;
+    luma_vertex_shader_.Reset();
+    luma_pixel_shader_.Reset();
     current_frame_.Reset();
     context_.Reset();
     device_.Reset();
@@ -69,6 +93,9 @@ std::optional<CaptureFrame> CaptureEngine::AcquireFrame() {
     if (hr == DXGI_ERROR_ACCESS_LOST) {
         Logger::Error(L"Desktop duplication access lost");
         staging_.Reset();
+        luma_rtv_.Reset();
+        luma_source_srv_.Reset();
+        luma_source_texture_ = nullptr;
         frame_acquired_ = false;
         current_frame_.Reset();
         needs_reinitialize_ = true;
@@ -79,6 +106,9 @@ std::optional<CaptureFrame> CaptureEngine::AcquireFrame() {
         Logger::Error(L"AcquireNextFrame failed");
         duplication_.Reset();
         staging_.Reset();
+        luma_rtv_.Reset();
+        luma_source_srv_.Reset();
+        luma_source_texture_ = nullptr;
         frame_acquired_ = false;
         current_frame_.Reset();
         needs_reinitialize_ = true;
@@ -96,7 +126,21 @@ std::optional<CaptureFrame> CaptureEngine::AcquireFrame() {
 
     current_frame_->GetDesc(&frame_desc_);
 
-    context_->CopyResource(staging_.Get(), current_frame_.Get());
+    if (luma_mode_ && !ConvertToLuma(current_frame_.Get())) {
+        duplication_->ReleaseFrame();
+        frame_acquired_ = false;
+        current_frame_.Reset();
+        Logger::Error(L"Luma conversion failed, capturing BGRA");
+        luma_mode_ = false;
+        if (!CreateFrameTarget()) {
+            duplication_.Reset();
+            needs_reinitialize_ = true;
+        }
+        return std::nullopt;
+    }
+    if (!luma_mode_) {
+        context_->CopyResource(staging_.Get(), current_frame_.Get());
+    }
 
     duplication_->ReleaseFrame();
     frame_acquired_ = false;
@@ -127,6 +171,9 @@ bool CaptureEngine::Reinitialize() {
 
     duplication_.Reset();
     staging_.Reset();
+    luma_rtv_.Reset();
+    luma_source_srv_.Reset();
+    luma_source_texture_ = nullptr;
     frame_acquired_ = false;
     current_frame_.Reset();
 
@@ -139,6 +186,18 @@ bool CaptureEngine::Reinitialize() {
     return true;
 }
 
+void CaptureEngine::SetLumaMode(bool enabled) {
+    if (luma_mode_ == enabled) {
+        return;
+    }
+
+    luma_mode_ = enabled;
+    if (device_ && duplication_ && !CreateFrameTarget()) {
+        duplication_.Reset();
+        needs_reinitialize_ = true;
+    }
+}
+
 bool CaptureEngine::EnsureDevice() {
     if (device_) {
         return true;
@@ -242,12 +301,132 @@ bool CaptureEngine::CreateDuplication(const MonitorInfo& source) {
     frame_desc_.CPUAccessFlags = 0;
     frame_desc_.MiscFlags = 0;
 
+    return CreateFrameTarget();
+}
+
+bool CaptureEngine::CreateFrameTarget() {
     staging_.Reset();
-    hr = device_->CreateTexture2D(&frame_desc_, nullptr, &staging_);
+    luma_rtv_.Reset();
+    luma_source_srv_.Reset();
+    luma_source_texture_ = nullptr;
+
+    if (luma_mode_ && !EnsureLumaPipeline()) {
+        Logger::Error(L"Luma pipeline unavailable, capturing BGRA");
+        luma_mode_ = false;
+    }
+
+    D3D11_TEXTURE2D_DESC desc{};
+    desc.Width = frame_desc_.Width;
+    desc.Height = frame_desc_.Height;
+    desc.Format = luma_mode_ ? DXGI_FORMAT_R8_UNORM : frame_desc_.Format;
+    desc.ArraySize = 1;
+    desc.MipLevels = 1;
+    desc.SampleDesc.Count = 1;
+    desc.SampleDesc.Quality = 0;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    if (luma_mode_) {
+        desc.BindFlags |= D3D11_BIND_RENDER_TARGET;
+    }
+    desc.CPUAccessFlags = 0;
+    desc.MiscFlags = 0;
+
+    HRESULT hr = device_->CreateTexture2D(&desc, nullptr, &staging_);
     if (FAILED(hr)) {
         Logger::Error(L"Failed to create staging texture");
         return false;
     }
 
+    if (luma_mode_) {
+        hr = device_->CreateRenderTargetView(staging_.Get(), nullptr, &luma_rtv_);
+        if (FAILED(hr)) {
+            Logger::Error(L"Failed to create luma render target");
+            staging_.Reset();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CaptureEngine::EnsureLumaPipeline() {
+    if (luma_vertex_shader_ && luma_pixel_shader_) {
+        return true;
+    }
+
+    Microsoft::WRL::ComPtr<ID3DBlob> vs_blob;
+    Microsoft::WRL::ComPtr<ID3DBlob> ps_blob;
+    Microsoft::WRL::ComPtr<ID3DBlob> errors;
+
+    if (FAILED(D3DCompile(kLumaVertexShader, strlen(kLumaVertexShader), nullptr, nullptr, nullptr, "main", "vs_5_0", 0, 0, &vs_blob, &errors))) {
+        Logger::Error(L"Luma VS compile error");
+        return false;
+    }
+    if (FAILED(D3DCompile(kLumaPixelShader, strlen(kLumaPixelShader), nullptr, nullptr, nullptr, "main", "ps_5_0", 0, 0, &ps_blob, &errors))) {
+        Logger::Error(L"Luma PS compile error");
+        return false;
+    }
+
+    if (FAILED(device_->CreateVertexShader(vs_blob->GetBufferPointer(), vs_blob->GetBufferSize(), nullptr, &luma_vertex_shader_))) {
+        return false;
+    }
+    if (FAILED(device_->CreatePixelShader(ps_blob->GetBufferPointer(), ps_blob->GetBufferSize(), nullptr, &luma_pixel_shader_))) {
+        luma_vertex_shader_.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+bool CaptureEngine::ConvertToLuma(ID3D11Texture2D* source) {
+    if (!luma_rtv_) {
+        return false;
+    }
+
+    D3D11_TEXTURE2D_DESC desc{};
+    source->GetDesc(&desc);
+
+    // Duplication usually hands back the same desktop texture every frame,
+    // so the view is rebuilt only when the surface changes.
+    if (!luma_source_srv_ || luma_source_texture_ != source) {
+        luma_source_srv_.Reset();
+        luma_source_texture_ = nullptr;
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc{};
+        srv_desc.Format = desc.Format;
+        srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+        srv_desc.Texture2D.MipLevels = 1;
+
+        if (FAILED(device_->CreateShaderResourceView(source, &srv_desc, &luma_source_srv_))) {
+            Logger::Error(L"Failed to create luma source view");
+            return false;
+        }
+        luma_source_texture_ = source;
+    }
+
+    D3D11_VIEWPORT viewport{};
+    viewport.Width = static_cast<FLOAT>(desc.Width);
+    viewport.Height = static_cast<FLOAT>(desc.Height);
+    viewport.MinDepth = 0.0f;
+    viewport.MaxDepth = 1.0f;
+
+    // The magnifier leaves the previous frame bound as its source; release it
+    // before the same texture becomes the render target.
+    ID3D11ShaderResourceView* null_srv = nullptr;
+    context_->PSSetShaderResources(0, 1, &null_srv);
+    context_->OMSetRenderTargets(1, luma_rtv_.GetAddressOf(), nullptr);
+    context_->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
+    context_->RSSetViewports(1, &viewport);
+    context_->IASetInputLayout(nullptr);
+    context_->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    context_->VSSetShader(luma_vertex_shader_.Get(), nullptr, 0);
+    context_->PSSetShader(luma_pixel_shader_.Get(), nullptr, 0);
+    context_->PSSetShaderResources(0, 1, luma_source_srv_.GetAddressOf());
+
+    context_->Draw(3, 0);
+
+    // Unbind so the luma target can be sampled by the magnifier.
+    context_->PSSetShaderResources(0, 1, &null_srv);
+    context_->OMSetRenderTargets(0, nullptr, nullptr);
     return true;
 }
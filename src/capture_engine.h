@@ -27,6 +27,11 @@ public:
     bool NeedsReinitialize() const { return needs_reinitialize_; }
     bool Reinitialize();
 
+    // When enabled, each captured frame is converted to 8-bit luma (R8_UNORM)
+    // instead of being copied as BGRA, so downstream sampling moves a quarter
+    // of the bytes. Used while grayscale output is active.
+    void SetLumaMode(bool enabled);
+
     ID3D11Device* Device() const { return device_.Get(); }
     ID3D11DeviceContext* Context() const { return context_.Get(); }
     const DXGI_OUTPUT_DESC& OutputDesc() const { return output_desc_; }
@@ -35,15 +40,24 @@ public:
 private:
     bool EnsureDevice();
     bool CreateDuplication(const MonitorInfo& source);
+    bool CreateFrameTarget();
+    bool EnsureLumaPipeline();
+    bool ConvertToLuma(ID3D11Texture2D* source);
 
     Microsoft::WRL::ComPtr<ID3D11Device> device_;
     Microsoft::WRL::ComPtr<ID3D11DeviceContext> context_;
     Microsoft::WRL::ComPtr<IDXGIOutputDuplication> duplication_;
     Microsoft::WRL::ComPtr<ID3D11Texture2D> staging_;
+    Microsoft::WRL::ComPtr<ID3D11RenderTargetView> luma_rtv_;
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> luma_source_srv_;
+    ID3D11Texture2D* luma_source_texture_{};
+    Microsoft::WRL::ComPtr<ID3D11VertexShader> luma_vertex_shader_;
+    Microsoft::WRL::ComPtr<ID3D11PixelShader> luma_pixel_shader_;
     Microsoft::WRL::ComPtr<ID3D11Texture2D> current_frame_;
     bool frame_acquired_{false};
     DXGI_OUTPUT_DESC output_desc_{};
     D3D11_TEXTURE2D_DESC frame_desc_{};
     std::optional<MonitorInfo> source_monitor_;
     bool needs_reinitialize_{false};
+    bool luma_mode_{false};
 };
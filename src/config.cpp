@@ -84,6 +84,7 @@ bool Config::Load() {
     data_.block_cursor = read_bool("blockCursor", data_.block_cursor);
     data_.auto_launch = read_bool("autoLaunch", data_.auto_launch);
     data_.invert_colors = read_bool("invertColors", data_.invert_colors);
+    data_.grayscale = read_bool("grayscale", data_.grayscale);
 
     std::wstring mode = read_string("trackingMode");
     if (mode == L"Caret") {
@@ -129,7 +130,8 @@ bool Config::Save() {
     out << "  \"trackingMode\": \"" << mode << "\",\n";
     out << "  \"blockCursor\": " << (data_.block_cursor ? "true" : "false") << ",\n";
     out << "  \"autoLaunch\": " << (data_.auto_launch ? "true" : "false") << ",\n";
-    out << "  \"invertColors\": " << (data_.invert_colors ? "true" : "false") << "\n";
+    out << "  \"invertColors\": " << (data_.invert_colors ? "true" : "false") << ",\n";
+    out << "  \"grayscale\": " << (data_.grayscale ? "true" : "false") << "\n";
     out << "}\n";
     return true;
 }
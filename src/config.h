@@ -15,6 +15,7 @@ struct AppConfig {
     bool block_cursor{true};
     bool auto_launch{false};
     bool invert_colors{false};
+    bool grayscale{false};
 };
 
 class Config {
@@ -19,6 +19,7 @@ bool HotkeyManager::RegisterDefaults(HWND target) {
 
     RegisterCombo(target, modifiers, 'T', HotkeyAction::SwitchMode);
     RegisterCombo(target, modifiers, 'I', HotkeyAction::ToggleInvert);
+    RegisterCombo(target, modifiers, 'G', HotkeyAction::ToggleGrayscale);
     RegisterCombo(target, modifiers, 'X', HotkeyAction::ShowCurrentTime);
     RegisterCombo(target, modifiers, 'C', HotkeyAction::ShowCurrentTime);
     RegisterCombo(target, modifiers, 'P', HotkeyAction::ToggleMousePassThrough);
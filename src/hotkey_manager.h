@@ -10,6 +10,7 @@ enum class HotkeyAction {
     ZoomOut,
     SwitchMode,
     ToggleInvert,
+    ToggleGrayscale,
     SwapMonitors,
     ToggleMousePassThrough,
     OpenSettings,
@@ -141,8 +141,8 @@ void MagnifierWindow::PresentFrame(const CaptureFrame& frame, const ViewState& s
     constants.uv_rect[2] = width;
     constants.uv_rect[3] = height;
     constants.render_flags[0] = state.invert_colors ? 1.0f : 0.0f;
-    constants.render_flags[1] = 0.0f;
-    constants.render_flags[2] = 0.0f;
+    constants.render_flags[1] = state.grayscale ? 1.0f : 0.0f;
+    constants.render_flags[2] = desc.Format == DXGI_FORMAT_R8_UNORM ? 1.0f : 0.0f;
     constants.render_flags[3] = 0.0f;
 
     context_->UpdateSubresource(constant_buffer_.Get(), 0, nullptr, &constants, 0, 0);
@@ -282,6 +282,11 @@ bool MagnifierWindow::CreatePipeline() {
         };
         float4 main(PSInput input) : SV_TARGET {
             float4 color = source_tex.Sample(linear_sampler, input.uv);
+            if (render_flags.z > 0.5f) {
+                color = float4(color.rrr, 1.0f);
+            } else if (render_flags.y > 0.5f) {
+                color.rgb = dot(color.rgb, float3(0.2126f, 0.7152f, 0.0722f));
+            }
             if (render_flags.x > 0.5f) {
                 color.rgb = 1.0f - color.rgb;
             }
@@ -16,6 +16,7 @@ struct ViewState {
     float zoom{2.0f};
     bool cursor_visible{false};
     bool invert_colors{false};
+    bool grayscale{false};
     float cursor_x{0.0f};
     float cursor_y{0.0f};
 };